@@ -0,0 +1,945 @@
+#include "ID3.h"
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+#include <queue>
+#include <algorithm>
+#include <ctime>
+#include <iomanip>
+#include <cmath>
+#include <climits>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+
+#ifdef _WIN32
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace std;
+
+vector<vector<string>> alldata;
+vector<unordered_set<string>> allValues;
+vector<unordered_map<string, int>> valueCodes;
+string recClass = "recurrence-events";
+int minSampleSize = 50;
+
+bool isRecRow(const vector<string>& row) {
+    return row[0] == recClass;
+}
+
+struct Node {
+    bool isRec;
+    bool isLeaf = false;
+    int errors = 0;
+    int leafErrors = 0;
+    int attribute;
+    string value;
+    Node* parent = nullptr;
+    vector<Node*> children;
+    unordered_set<int> prevAttributes;
+};
+
+struct DataSet {
+    vector<vector<string>> rows;
+    vector<unordered_set<string>> attrValues;
+    vector<unordered_map<string, int>> table[2];
+
+    int datasize = 0;
+    int noRecSize = 0;
+    int recSize = 0;
+
+    DataSet() {
+        table[0].resize(allValues.size());
+        table[1].resize(allValues.size());
+    }
+
+    DataSet(vector<vector<string>> rows) : DataSet() {
+        this->rows = rows;
+        getAttrValuesFromRows();
+        fromRowsToTable();
+    }
+
+    void getAttrValuesFromRows() {
+        attrValues.resize(allValues.size());
+        for (int i = 0; i < rows.size(); i++) {
+            for (int j = 1; j < rows[i].size(); j++) {
+                attrValues[j].insert(rows[i][j]);
+            }
+        }
+    }
+
+    void fromRowsToTable() {
+        for (int i = 0; i < rows.size(); i++) {
+            addRowToTable(rows[i]);
+        }
+    }
+
+    void addRowToTable(const vector<string>& row) {
+        bool isRec = isRecRow(row);
+        isRec ? recSize++ : noRecSize++;
+        for (int j = 1; j < row.size(); j++) {
+            table[isRec][j][row[j]]++;
+        }
+        datasize = recSize + noRecSize;
+    }
+
+    double entropy(double a, double b) {
+        if (a == 0 || b == 0) {
+            return 0;
+        }
+        double pa = a / (a + b);
+        double pb = b / (a + b);
+        return -(pa)*log2(pa) - (pb)*log2(pb);
+    }
+
+    double entropyAttr(int attrIndex) {
+        string key;
+        double entr = 0;
+        double noRec, rec;
+        for (auto it = table[0][attrIndex].begin(); it != table[0][attrIndex].end(); ++it) {
+            key = it->first;
+            noRec = it->second;
+            rec = table[1][attrIndex][key];
+            entr += ((noRec + rec) / datasize) * entropy(noRec, rec);
+        }
+        return entr;
+    }
+
+    double infoGain(int attrIndex) {
+        return entropy(noRecSize, recSize) - entropyAttr(attrIndex);
+    }
+
+    int findBestAttribute(unordered_set<int> prevAttributes) {
+        double maxInfoGain = INT_MIN;
+        double curInfoGain;
+        int bestAttr = 1;
+
+        for (int curAttr = 1; curAttr < allValues.size(); curAttr++) {
+            if (prevAttributes.find(curAttr) == prevAttributes.end()) {
+                curInfoGain = infoGain(curAttr);
+                if (curInfoGain > maxInfoGain) {
+                    maxInfoGain = curInfoGain;
+                    bestAttr = curAttr;
+                }
+            }
+        }
+        return bestAttr;
+    }
+
+    DataSet* filter(int attr, string value) {
+        vector<vector<string>> newRows;
+        for (int i = 0; i < rows.size(); i++) {
+            if (value.compare(rows[i][attr]) == 0) {
+                newRows.push_back(rows[i]);
+            }
+        }
+        return new DataSet(newRows);
+    }
+
+    bool isRecMoreCommon(Node* node) {
+        return recSize > noRecSize;
+    }
+};
+
+struct DecisionTree {
+    Node* root = nullptr;
+
+    virtual ~DecisionTree() {
+        deleteSubtree(root);
+    }
+
+    void deleteSubtree(Node* node) {
+        if (node == nullptr) {
+            return;
+        }
+        for (Node* child : node->children) {
+            deleteSubtree(child);
+        }
+        delete node;
+    }
+
+    void buildAttributeNode(DataSet* dataset, Node* parentNode) {
+        Node* childNode;
+        if (parentNode == nullptr) {
+            root = new Node();
+            childNode = root;
+        }
+        else {
+            childNode = new Node();
+            childNode->prevAttributes = parentNode->prevAttributes;
+            parentNode->children.push_back(childNode);
+        }
+        int bestAttr = dataset->findBestAttribute(childNode->prevAttributes);
+        childNode->attribute = bestAttr;
+        childNode->prevAttributes.insert(bestAttr);
+        childNode->parent = parentNode;
+        childNode->isRec = dataset->isRecMoreCommon(childNode);
+
+        unordered_set<string> attrValues = allValues[bestAttr];
+        for (string value : attrValues) {
+            buildValueNode(bestAttr, value, childNode, dataset);
+        }
+    }
+
+    virtual void buildValueNode(int attr, string value, Node* parentNode, DataSet* dataset) = 0;
+
+    bool classify(const vector<string>& row) {
+        Node* node = root;
+        while (true) {
+            const string& value = row[node->attribute];
+
+            for (int i = 0; i < node->children.size(); i++) {
+                if (value.compare(node->children[i]->value) == 0) {
+                    if (node->children[i]->isLeaf) {
+                        return node->children[i]->isRec == isRecRow(row);
+                    }
+                    node = node->children[i]->children[0];
+                    break;
+                }
+            }
+        }
+    }
+
+    bool isEntropyZero(DataSet* dataset) {
+        return dataset->entropy(dataset->recSize, dataset->noRecSize) == 0;
+    }
+
+    bool isStoppingPoint(DataSet* dataset, Node* parentNode) {
+        return isEntropyZero(dataset) || parentNode->prevAttributes.size() == allValues.size() - 1 || dataset->datasize < minSampleSize;
+    }
+};
+
+struct DecisionTreePrePruning : public DecisionTree {
+    DecisionTreePrePruning(DataSet* dataset) {
+        buildAttributeNode(dataset, nullptr);
+    }
+
+    void buildValueNode(int attr, string value, Node* parentNode, DataSet* dataset) {
+        if (isStoppingPoint(dataset, parentNode)) {
+            Node* leaf = new Node();
+            leaf->value = value;
+            leaf->isLeaf = true;
+            leaf->parent = parentNode;
+            leaf->isRec = dataset->isRecMoreCommon(leaf);
+            parentNode->children.push_back(leaf);
+            return;
+        }
+        Node* childNode = new Node();
+        childNode->attribute = attr;
+        childNode->value = value;
+        childNode->prevAttributes = parentNode->prevAttributes;
+        childNode->parent = parentNode;
+        childNode->isRec = dataset->isRecMoreCommon(childNode);
+        parentNode->children.push_back(childNode);
+        DataSet* subset = dataset->filter(attr, value);
+        buildAttributeNode(subset, childNode);
+        delete subset;
+    }
+};
+
+struct DecisionTreePostPruning : public DecisionTree {
+    vector<vector<string>> validationset;
+
+    DecisionTreePostPruning(DataSet* dataset) {
+        auto splitData = stratifiedSplit(dataset);
+        DataSet* trainSet = splitData.first;
+        validationset = splitData.second;
+
+        buildAttributeNode(trainSet, nullptr);
+        delete trainSet;
+        routeValidationSet();
+        pruneTree();
+    }
+
+    pair<DataSet*, vector<vector<string>>> stratifiedSplit(DataSet* dataset) {
+        vector<vector<string>> trainRows;
+        vector<vector<string>> validRows;
+
+        int validSize = dataset->rows.size() / 10;
+        int trainingSize = dataset->rows.size() - validSize;
+
+        for (int i = 0; i < dataset->rows.size(); i++) {
+            if (i < trainingSize) {
+                trainRows.push_back(dataset->rows[i]);
+            }
+            else {
+                validRows.push_back(dataset->rows[i]);
+            }
+        }
+
+        return { new DataSet(trainRows), validRows };
+    }
+
+    void buildValueNode(int attr, string value, Node* parentNode, DataSet* dataset) {
+        if (isStoppingPoint(dataset, parentNode)) {
+            Node* leaf = new Node();
+            leaf->value = value;
+            leaf->isLeaf = true;
+            leaf->parent = parentNode;
+            leaf->isRec = dataset->isRecMoreCommon(leaf);
+            parentNode->children.push_back(leaf);
+            return;
+        }
+
+        Node* childNode = new Node();
+        childNode->attribute = attr;
+        childNode->value = value;
+        childNode->prevAttributes = parentNode->prevAttributes;
+        childNode->parent = parentNode;
+        childNode->isRec = dataset->isRecMoreCommon(childNode);
+        parentNode->children.push_back(childNode);
+
+        DataSet* subset = dataset->filter(attr, value);
+        buildAttributeNode(subset, childNode);
+        delete subset;
+    }
+
+    void routeValidationSet() {
+        for (const auto& row : validationset) {
+            bool rowIsRec = isRecRow(row);
+            Node* node = root;
+            while (node != nullptr) {
+                Node* next = nullptr;
+                for (Node* child : node->children) {
+                    if (row[node->attribute].compare(child->value) == 0) {
+                        if (child->isRec != rowIsRec) {
+                            child->leafErrors++;
+                        }
+                        next = child->isLeaf ? nullptr : child->children[0];
+                        break;
+                    }
+                }
+                node = next;
+            }
+        }
+    }
+
+    void postPrune(Node* node, bool isValueNode) {
+        if (node->isLeaf) {
+            node->errors = node->leafErrors;
+            return;
+        }
+
+        node->errors = 0;
+        for (Node* child : node->children) {
+            postPrune(child, !isValueNode);
+            node->errors += child->errors;
+        }
+
+        if (isValueNode && node->leafErrors < node->errors) {
+            node->isLeaf = true;
+            node->errors = node->leafErrors;
+        }
+    }
+
+    void pruneTree() {
+        postPrune(root, false);
+    }
+};
+
+struct MappedCsvReader {
+    static const size_t CHUNK_SIZE = 64 << 20;
+
+    string filename;
+    size_t fileSize = 0;
+    size_t columnCount = 0;
+    size_t granularity = 1;
+#ifdef _WIN32
+    HANDLE file = INVALID_HANDLE_VALUE;
+    HANDLE mapping = nullptr;
+#else
+    int file = -1;
+#endif
+
+    MappedCsvReader(const string& filename) : filename(filename) {
+#ifdef _WIN32
+        SYSTEM_INFO info;
+        GetSystemInfo(&info);
+        granularity = info.dwAllocationGranularity;
+        file = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        LARGE_INTEGER size;
+        if (file != INVALID_HANDLE_VALUE && GetFileSizeEx(file, &size)) {
+            fileSize = size.QuadPart;
+            mapping = fileSize > 0 ? CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr) : nullptr;
+        }
+#else
+        granularity = sysconf(_SC_PAGESIZE);
+        file = open(filename.c_str(), O_RDONLY);
+        struct stat info;
+        if (file >= 0 && fstat(file, &info) == 0) {
+            fileSize = info.st_size;
+        }
+#endif
+    }
+
+    ~MappedCsvReader() {
+#ifdef _WIN32
+        if (mapping != nullptr) {
+            CloseHandle(mapping);
+        }
+        if (file != INVALID_HANDLE_VALUE) {
+            CloseHandle(file);
+        }
+#else
+        if (file >= 0) {
+            close(file);
+        }
+#endif
+    }
+
+    MappedCsvReader(const MappedCsvReader&) = delete;
+    MappedCsvReader& operator=(const MappedCsvReader&) = delete;
+
+    bool isOpen() const {
+#ifdef _WIN32
+        return file != INVALID_HANDLE_VALUE;
+#else
+        return file >= 0;
+#endif
+    }
+
+    char* mapWindow(size_t start, size_t length) {
+#ifdef _WIN32
+        void* view = MapViewOfFile(mapping, FILE_MAP_READ, DWORD(uint64_t(start) >> 32), DWORD(start), length);
+        return static_cast<char*>(view);
+#else
+        void* view = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, file, start);
+        if (view == MAP_FAILED) {
+            return nullptr;
+        }
+        madvise(view, length, MADV_SEQUENTIAL);
+        return static_cast<char*>(view);
+#endif
+    }
+
+    void unmapWindow(char* view, size_t length) {
+#ifdef _WIN32
+        UnmapViewOfFile(view);
+#else
+        munmap(view, length);
+#endif
+    }
+
+    static void splitLine(const char* begin, const char* end, vector<string>& row) {
+        if (end > begin && end[-1] == '\r') {
+            end--;
+        }
+        size_t column = 0;
+        const char* fieldStart = begin;
+        while (true) {
+            const char* fieldEnd = static_cast<const char*>(memchr(fieldStart, ',', end - fieldStart));
+            if (fieldEnd == nullptr) {
+                fieldEnd = end;
+            }
+            if (column == row.size()) {
+                row.emplace_back();
+            }
+            row[column++].assign(fieldStart, fieldEnd);
+            if (fieldEnd == end) {
+                break;
+            }
+            fieldStart = fieldEnd + 1;
+        }
+        row.resize(column);
+    }
+
+    template <typename RowHandler>
+    bool forEachRow(RowHandler handleRow) {
+        if (!isOpen()) {
+            return false;
+        }
+
+        vector<string> row;
+        size_t offset = 0;
+        size_t chunkSize = CHUNK_SIZE;
+        while (offset < fileSize) {
+            size_t mapStart = offset - offset % granularity;
+            size_t mapLength = min(chunkSize, fileSize - mapStart);
+            bool isLastWindow = mapStart + mapLength == fileSize;
+            char* view = mapWindow(mapStart, mapLength);
+            if (view == nullptr) {
+                return false;
+            }
+
+            const char* end = view + mapLength;
+            const char* lineStart = view + (offset - mapStart);
+            while (lineStart < end) {
+                const char* lineEnd = static_cast<const char*>(memchr(lineStart, '\n', end - lineStart));
+                if (lineEnd == nullptr) {
+                    if (!isLastWindow) {
+                        break;
+                    }
+                    lineEnd = end;
+                }
+                if (lineEnd > lineStart && !(lineEnd - lineStart == 1 && *lineStart == '\r')) {
+                    splitLine(lineStart, lineEnd, row);
+                    if (columnCount == 0 || row.size() == columnCount) {
+                        handleRow(row);
+                    }
+                }
+                lineStart = min(lineEnd + 1, end);
+            }
+
+            size_t consumed = mapStart + (lineStart - view);
+            unmapWindow(view, mapLength);
+            if (consumed == offset) {
+                chunkSize *= 2;
+            }
+            offset = consumed;
+        }
+        return true;
+    }
+};
+
+struct DecisionTreeStreaming : public DecisionTree {
+    MappedCsvReader& reader;
+    unordered_map<Node*, DataSet*> pending;
+
+    DecisionTreeStreaming(MappedCsvReader& reader) : reader(reader) {
+        DataSet* rootStats = new DataSet();
+        reader.forEachRow([&](const vector<string>& row) {
+            rootStats->addRowToTable(row);
+        });
+        buildAttributeNode(rootStats, nullptr);
+        delete rootStats;
+
+        while (!pending.empty()) {
+            reader.forEachRow([&](const vector<string>& row) {
+                Node* valueNode = routeToPending(row);
+                if (valueNode != nullptr) {
+                    pending[valueNode]->addRowToTable(row);
+                }
+            });
+
+            unordered_map<Node*, DataSet*> level;
+            level.swap(pending);
+            for (auto& entry : level) {
+                buildAttributeNode(entry.second, entry.first);
+                delete entry.second;
+            }
+        }
+    }
+
+    Node* routeToPending(const vector<string>& row) {
+        Node* node = root;
+        while (true) {
+            Node* next = nullptr;
+            for (Node* child : node->children) {
+                if (row[node->attribute].compare(child->value) == 0) {
+                    next = child;
+                    break;
+                }
+            }
+            if (next == nullptr || next->isLeaf) {
+                return nullptr;
+            }
+            if (next->children.empty()) {
+                return next;
+            }
+            node = next->children[0];
+        }
+    }
+
+    void buildValueNode(int attr, string value, Node* parentNode, DataSet* dataset) {
+        if (isStoppingPoint(dataset, parentNode)) {
+            Node* leaf = new Node();
+            leaf->value = value;
+            leaf->isLeaf = true;
+            leaf->parent = parentNode;
+            leaf->isRec = dataset->isRecMoreCommon(leaf);
+            parentNode->children.push_back(leaf);
+            return;
+        }
+
+        Node* childNode = new Node();
+        childNode->attribute = attr;
+        childNode->value = value;
+        childNode->prevAttributes = parentNode->prevAttributes;
+        childNode->parent = parentNode;
+        childNode->isRec = dataset->isRecMoreCommon(childNode);
+        parentNode->children.push_back(childNode);
+
+        pending[childNode] = new DataSet();
+    }
+};
+
+const size_t MAX_VALUE_CODES = size_t(UINT16_MAX) + 1;
+
+struct EncodedRows {
+    int stride;
+    size_t size;
+    vector<uint16_t> codes;
+    vector<char> isRec;
+};
+
+struct CompiledTree {
+    static const int NO_REC_LEAF = -1;
+    static const int REC_LEAF = -2;
+    static const size_t MIN_ROWS_PER_THREAD = 4096;
+
+    vector<int> arena;
+
+    CompiledTree(Node* root) {
+        compileAttributeNode(root);
+    }
+
+    int leafCode(bool isRec) {
+        return isRec ? REC_LEAF : NO_REC_LEAF;
+    }
+
+    int compileAttributeNode(Node* node) {
+        int index = arena.size();
+        int attr = node->attribute;
+        arena.push_back(attr);
+        arena.resize(arena.size() + valueCodes[attr].size(), leafCode(node->isRec));
+
+        for (Node* child : node->children) {
+            int target = child->isLeaf ? leafCode(child->isRec) : compileAttributeNode(child->children[0]);
+            arena[index + 1 + valueCodes[attr].at(child->value)] = target;
+        }
+        return index;
+    }
+
+    bool classify(const uint16_t* row) const {
+        int node = 0;
+        while (node >= 0) {
+            node = arena[node + 1 + row[arena[node]]];
+        }
+        return node == REC_LEAF;
+    }
+
+    void classifyBatch(const EncodedRows& rows, vector<char>& predictions) const {
+        predictions.resize(rows.size);
+
+        size_t threadCount = max<size_t>(1, thread::hardware_concurrency());
+        threadCount = min(threadCount, max<size_t>(1, rows.size / MIN_ROWS_PER_THREAD));
+        size_t chunkSize = (rows.size + threadCount - 1) / threadCount;
+
+        auto classifyRange = [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; i++) {
+                predictions[i] = classify(&rows.codes[i * rows.stride]);
+            }
+        };
+
+        vector<thread> workers;
+        for (size_t t = 1; t < threadCount; t++) {
+            size_t begin = t * chunkSize;
+            size_t end = min(rows.size, begin + chunkSize);
+            if (begin < end) {
+                workers.emplace_back(classifyRange, begin, end);
+            }
+        }
+        classifyRange(0, min(rows.size, chunkSize));
+        for (thread& worker : workers) {
+            worker.join();
+        }
+    }
+
+    double accuracy(const EncodedRows& rows) const {
+        vector<char> predictions;
+        classifyBatch(rows, predictions);
+
+        int correctCount = 0;
+        for (size_t i = 0; i < rows.size; i++) {
+            if (predictions[i] == rows.isRec[i]) {
+                correctCount++;
+            }
+        }
+        return static_cast<double>(correctCount) / rows.size * 100;
+    }
+};
+
+bool buildValueCodes() {
+    valueCodes.assign(allValues.size(), unordered_map<string, int>());
+    for (int attr = 0; attr < allValues.size(); attr++) {
+        if (allValues[attr].size() > MAX_VALUE_CODES) {
+            cerr << "Column " << attr << " has more than " << MAX_VALUE_CODES << " distinct values." << endl;
+            return false;
+        }
+        for (const string& value : allValues[attr]) {
+            int code = valueCodes[attr].size();
+            valueCodes[attr][value] = code;
+        }
+    }
+    return true;
+}
+
+EncodedRows encodeRows(const vector<vector<string>>& rows) {
+    EncodedRows encoded;
+    encoded.stride = valueCodes.size();
+    encoded.size = rows.size();
+    encoded.codes.resize(encoded.size * encoded.stride);
+    encoded.isRec.resize(encoded.size);
+
+    for (size_t i = 0; i < rows.size(); i++) {
+        for (int j = 0; j < encoded.stride; j++) {
+            encoded.codes[i * encoded.stride + j] = valueCodes[j].at(rows[i][j]);
+        }
+        encoded.isRec[i] = isRecRow(rows[i]);
+    }
+    return encoded;
+}
+
+void selectRecClass() {
+    if (!allValues.empty() && !allValues[0].empty()) {
+        recClass = *max_element(allValues[0].begin(), allValues[0].end());
+    }
+}
+
+void readFromFile(const string& filename) {
+    string line, attribute;
+    ifstream filein(filename, ios::in);
+    int counter = 0;
+    while (getline(filein, line)) {
+        stringstream ss(line);
+        vector<string> attributes;
+        while (getline(ss, attribute, ',')) {
+            attributes.push_back(attribute);
+            if (counter == allValues.size()) {
+                allValues.emplace_back();
+            }
+            allValues[counter].insert(attribute);
+            counter++;
+        }
+        alldata.push_back(attributes);
+        counter = 0;
+    }
+    selectRecClass();
+    random_shuffle(alldata.begin(), alldata.end());
+    filein.close();
+}
+
+bool discoverSchema(MappedCsvReader& reader) {
+    allValues.clear();
+    reader.columnCount = 0;
+    bool isConsistent = true;
+    bool isRead = reader.forEachRow([&](const vector<string>& row) {
+        if (allValues.empty()) {
+            allValues.resize(row.size());
+        }
+        if (row.size() != allValues.size()) {
+            isConsistent = false;
+            return;
+        }
+        for (int j = 0; j < row.size(); j++) {
+            allValues[j].insert(row[j]);
+        }
+    });
+    if (!isRead) {
+        cerr << "Error while opening " << reader.filename << "." << endl;
+        return false;
+    }
+    if (!isConsistent) {
+        cerr << "Inconsistent number of columns in " << reader.filename << "." << endl;
+        return false;
+    }
+    if (allValues.size() < 2) {
+        cerr << "No attributes found in " << reader.filename << "." << endl;
+        return false;
+    }
+    if (allValues[0].size() > 2) {
+        cerr << "Expected at most two classes in " << reader.filename << "." << endl;
+        return false;
+    }
+    for (int j = 1; j < allValues.size(); j++) {
+        if (allValues[j].size() > MAX_VALUE_CODES) {
+            cerr << "Column " << j << " of " << reader.filename << " has more than " << MAX_VALUE_CODES << " distinct values." << endl;
+            return false;
+        }
+    }
+    reader.columnCount = allValues.size();
+    selectRecClass();
+    return true;
+}
+
+bool calculateStreamingAccuracy(const string& filename, double& accuracy, int& rowCount) {
+    MappedCsvReader reader(filename);
+    if (!discoverSchema(reader) || !buildValueCodes()) {
+        return false;
+    }
+
+    DecisionTreeStreaming* tree = new DecisionTreeStreaming(reader);
+    CompiledTree compiled(tree->root);
+    delete tree;
+
+    vector<uint16_t> codes(valueCodes.size());
+    int correctCount = 0;
+    rowCount = 0;
+    reader.forEachRow([&](const vector<string>& row) {
+        for (int j = 0; j < row.size(); j++) {
+            codes[j] = valueCodes[j].at(row[j]);
+        }
+        bool isRec = isRecRow(row);
+        if (compiled.classify(codes.data()) == isRec) {
+            correctCount++;
+        }
+        rowCount++;
+    });
+    accuracy = static_cast<double>(correctCount) / rowCount * 100;
+    return true;
+}
+
+double calculateStandardDeviation(const vector<double>& accuracies) {
+    double sum = 0.0;
+    double mean = 0.0;
+    for (size_t i = 0; i < accuracies.size(); i++) {
+        sum += accuracies[i];
+    }
+    mean = sum / accuracies.size();
+    double variance = 0.0;
+    for (size_t i = 0; i < accuracies.size(); i++) {
+        variance += std::pow(accuracies[i] - mean, 2);
+    }
+    variance /= accuracies.size();
+    return std::sqrt(variance);
+}
+
+void stratifiedSplit(vector<vector<string>>& dataset, vector<vector<string>>& trainSet, vector<vector<string>>& testSet) {
+    int testSize = dataset.size() * 20 / 100; 
+    int trainSize = dataset.size() - testSize; 
+
+    for (int i = 0; i < dataset.size(); i++) {
+        if (i < trainSize) {
+            trainSet.push_back(dataset[i]);
+        }
+        else {
+            testSet.push_back(dataset[i]);
+        }
+    }
+}
+
+double calculateTrainAccuracy(vector<vector<string>>& trainset, int mode) {
+    DataSet* trainDataSet = new DataSet(trainset);
+    DecisionTree* tree;
+
+    if (mode == 0) {
+        tree = new DecisionTreePrePruning(trainDataSet);
+    }
+    else {
+        tree = new DecisionTreePostPruning(trainDataSet);
+    }
+
+    CompiledTree compiled(tree->root);
+    delete tree;
+    delete trainDataSet;
+
+    return compiled.accuracy(encodeRows(trainset));
+}
+
+double calculateAccuracyTestSet(vector<vector<string>>& trainset, vector<vector<string>>& testset, int mode) {
+    DataSet* testDataSet = new DataSet(testset);
+    DecisionTree* tree;
+
+    if (mode == 0) {
+        tree = new DecisionTreePrePruning(testDataSet);
+    }
+    else {
+        tree = new DecisionTreePostPruning(testDataSet);
+    }
+
+    CompiledTree compiled(tree->root);
+    delete tree;
+    delete testDataSet;
+
+    return compiled.accuracy(encodeRows(testset));
+}
+
+void tenFoldCrossValidate(int mode) {
+    vector<double> accuracies;
+    vector<vector<string>> shuffledData = alldata;
+
+    random_shuffle(shuffledData.begin(), shuffledData.end());
+
+    int foldSize = shuffledData.size() / 10;
+    for (int i = 0; i < 10; i++) {
+        vector<vector<string>> trainset, testset;
+
+        int start = i * foldSize;
+        int end = (i == 9) ? shuffledData.size() : (i + 1) * foldSize;
+
+        for (int j = start; j < end; j++) {
+            testset.push_back(shuffledData[j]);
+        }
+
+        for (int j = 0; j < shuffledData.size(); j++) {
+            if (j < start || j >= end) {
+                trainset.push_back(shuffledData[j]);
+            }
+        }
+
+        double accuracy = (mode == 0)
+            ? calculateTrainAccuracy(trainset, mode)
+            : calculateAccuracyTestSet(trainset, testset, mode);
+
+        accuracies.push_back(accuracy);
+    }
+
+    double meanAccuracy = 0;
+    for (double acc : accuracies) {
+        meanAccuracy += acc;
+    }
+    meanAccuracy /= accuracies.size();
+
+    double stdDev = calculateStandardDeviation(accuracies);
+
+    cout << "10-Fold Cross-Validation Results:" << endl;
+    for (int i = 0; i < 10; i++) {
+        cout << "   Accuracy Fold " << i + 1 << ": " << fixed << setprecision(2) << accuracies[i] << "%" << endl;
+    }
+
+    cout << endl;
+    cout << "   Average Accuracy: " << fixed << setprecision(2) << meanAccuracy << "%" << endl;
+    cout << "   Standard Deviation: " << fixed << setprecision(2) << stdDev << "%" << endl << endl;
+}
+
+#ifndef SOLVER_LIBRARY
+int main(int argc, char* argv[]) {
+    string filename = (argc > 1) ? argv[1] : "breast-cancer.data";
+    int mode;
+    cout << "Enter 0 for pre-pruning, 1 for post-pruning or 2 for streaming pre-pruning. ";
+    cin >> mode;
+
+    if (mode == 2) {
+        double trainAccuracy;
+        int rowCount;
+        if (!calculateStreamingAccuracy(filename, trainAccuracy, rowCount)) {
+            return 1;
+        }
+
+        cout << endl << "1. Train Set Accuracy (streaming, " << rowCount << " rows):" << endl << "   Accuracy: " << fixed << setprecision(2) << trainAccuracy << "%" << endl;
+        return 0;
+    }
+
+    std::srand(unsigned(std::time(0)));
+    readFromFile(filename);
+    if (!buildValueCodes()) {
+        return 1;
+    }
+
+    vector<vector<string>> trainset;
+    vector<vector<string>> testset;
+    stratifiedSplit(alldata, trainset, testset);
+
+    double trainAccuracy = calculateTrainAccuracy(trainset, mode);
+    double testAccuracy = calculateAccuracyTestSet(trainset, testset, mode);
+
+    cout << endl << "1. Train Set Accuracy:" << endl << "   Accuracy: " << fixed << setprecision(2) << trainAccuracy << "%" << endl << endl;
+
+    tenFoldCrossValidate(mode);
+
+    cout << "2. Test Set Accuracy:" << endl << "   Accuracy: " << fixed << setprecision(2) << testAccuracy << "%" << endl;
+
+    return 0;
+}
+#endif
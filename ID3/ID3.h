@@ -0,0 +1,11 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+extern std::vector<std::vector<std::string>> alldata;
+
+void readFromFile(const std::string& filename);
+bool buildValueCodes();
+double calculateTrainAccuracy(std::vector<std::vector<std::string>>& trainset, int mode);
+bool calculateStreamingAccuracy(const std::string& filename, double& accuracy, int& rowCount);
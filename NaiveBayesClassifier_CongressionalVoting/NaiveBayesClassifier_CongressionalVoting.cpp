@@ -0,0 +1,488 @@
+#include "NaiveBayesClassifier_CongressionalVoting.h"
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <cmath>
+#include <algorithm>
+#include <iomanip>
+#include <random>
+#include <cstdint>
+#include <cstring>
+#include <unordered_map>
+#include <thread>
+
+#ifdef _WIN32
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+struct MappedFile {
+    const char* data = nullptr;
+    size_t size = 0;
+#ifdef _WIN32
+    HANDLE file = INVALID_HANDLE_VALUE;
+    HANDLE mapping = nullptr;
+#else
+    int file = -1;
+#endif
+
+    MappedFile(const std::string& filename) {
+#ifdef _WIN32
+        file = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        LARGE_INTEGER fileSize;
+        if (file == INVALID_HANDLE_VALUE || !GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0) {
+            return;
+        }
+        mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (mapping != nullptr) {
+            data = static_cast<const char*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+            size = data != nullptr ? static_cast<size_t>(fileSize.QuadPart) : 0;
+        }
+#else
+        file = open(filename.c_str(), O_RDONLY);
+        struct stat info;
+        if (file < 0 || fstat(file, &info) != 0 || info.st_size == 0) {
+            return;
+        }
+        void* view = mmap(nullptr, info.st_size, PROT_READ, MAP_PRIVATE, file, 0);
+        if (view != MAP_FAILED) {
+            madvise(view, info.st_size, MADV_SEQUENTIAL);
+            data = static_cast<const char*>(view);
+            size = info.st_size;
+        }
+#endif
+    }
+
+    ~MappedFile() {
+#ifdef _WIN32
+        if (data != nullptr) {
+            UnmapViewOfFile(data);
+        }
+        if (mapping != nullptr) {
+            CloseHandle(mapping);
+        }
+        if (file != INVALID_HANDLE_VALUE) {
+            CloseHandle(file);
+        }
+#else
+        if (data != nullptr) {
+            munmap(const_cast<char*>(data), size);
+        }
+        if (file >= 0) {
+            close(file);
+        }
+#endif
+    }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    bool isOpen() const {
+#ifdef _WIN32
+        return file != INVALID_HANDLE_VALUE;
+#else
+        return file >= 0;
+#endif
+    }
+};
+
+void parseRecord(const char* begin, const char* end, bool treatMissingAsAbstain, Record& record) {
+    if (end > begin && end[-1] == '\r') {
+        end--;
+    }
+
+    const char* tokenEnd = static_cast<const char*>(memchr(begin, ',', end - begin));
+    if (tokenEnd == nullptr) {
+        tokenEnd = end;
+    }
+    record.classLabel = (tokenEnd - begin == 8 && memcmp(begin, "democrat", 8) == 0) ? DEMOCRAT : REPUBLICAN;
+
+    const char* token = std::min(tokenEnd + 1, end);
+    for (int i = 0; i < NUM_ATTRIBUTES; ++i) {
+        tokenEnd = static_cast<const char*>(memchr(token, ',', end - token));
+        if (tokenEnd == nullptr) {
+            tokenEnd = end;
+        }
+        if (tokenEnd - token == 1 && *token == 'y') {
+            record.setAttribute(i, YES);
+        }
+        else if (tokenEnd - token == 1 && *token == 'n') {
+            record.setAttribute(i, NO);
+        }
+        else {
+            record.setAttribute(i, treatMissingAsAbstain ? ABSTAIN : MISSING);
+        }
+        token = std::min(tokenEnd + 1, end);
+    }
+}
+
+template <typename RecordHandler>
+size_t forEachRecord(const MappedFile& file, size_t offset, bool treatMissingAsAbstain, bool includeUnterminatedLine, RecordHandler handleRecord) {
+    const char* end = file.data + file.size;
+    const char* lineStart = file.data + offset;
+    Record record;
+    while (lineStart < end) {
+        const char* lineEnd = static_cast<const char*>(memchr(lineStart, '\n', end - lineStart));
+        if (lineEnd == nullptr) {
+            if (!includeUnterminatedLine) {
+                break;
+            }
+            lineEnd = end;
+        }
+        if (lineEnd > lineStart && !(lineEnd - lineStart == 1 && *lineStart == '\r')) {
+            parseRecord(lineStart, lineEnd, treatMissingAsAbstain, record);
+            handleRecord(record);
+        }
+        lineStart = std::min(lineEnd + 1, end);
+    }
+    return lineStart - file.data;
+}
+
+size_t ingestVoteLog(const std::string& filename, size_t offset, bool treatMissingAsAbstain, NaiveBayesModel& model) {
+    MappedFile file(filename);
+    if (file.size <= offset) {
+        return offset;
+    }
+    return forEachRecord(file, offset, treatMissingAsAbstain, false, [&](const Record& record) {
+        model.add(record);
+    });
+}
+
+void fillMissingValues(std::vector<Record>& records) {
+    for (int i = 0; i < NUM_ATTRIBUTES; ++i) {
+        int count[3] = { 0 };
+        for (const auto& record : records) {
+            if (record.attribute(i) != MISSING) {
+                count[record.attribute(i)]++;
+            }
+        }
+
+        Vote mostFrequent = YES;
+        if (count[NO] > count[mostFrequent]) {
+            mostFrequent = NO;
+        }
+        if (count[ABSTAIN] > count[mostFrequent]) {
+            mostFrequent = ABSTAIN;
+        }
+
+        for (auto& record : records) {
+            if (record.attribute(i) == MISSING) {
+                record.setAttribute(i, mostFrequent);
+            }
+        }
+    }
+}
+
+void readData(const std::string& filename, bool treatMissingAsAbstain, std::vector<Record>& records) {
+    MappedFile file(filename);
+    if (!file.isOpen()) {
+        std::cerr << "Error while opening the file." << std::endl;
+        return;
+    }
+
+    forEachRecord(file, 0, treatMissingAsAbstain, true, [&](const Record& record) {
+        records.push_back(record);
+    });
+
+    if (!treatMissingAsAbstain) {
+        fillMissingValues(records);
+    }
+}
+
+void stratifiedSplit(const std::vector<Record>& records, std::vector<Record>& train, std::vector<Record>& test, double splitRatio) {
+    std::vector<Record> democrats, republicans;
+
+    for (const auto& record : records) {
+        if (record.classLabel == DEMOCRAT) {
+            democrats.push_back(record);
+        }
+        else {
+            republicans.push_back(record);
+        }
+    }
+
+    std::random_device rd;
+    std::mt19937 g(rd());
+    std::shuffle(democrats.begin(), democrats.end(), g);
+    std::shuffle(republicans.begin(), republicans.end(), g);
+
+    size_t trainDemocrats = static_cast<size_t>(splitRatio * democrats.size());
+    size_t trainRepublicans = static_cast<size_t>(splitRatio * republicans.size());
+
+    train.insert(train.end(), democrats.begin(), democrats.begin() + trainDemocrats);
+    train.insert(train.end(), republicans.begin(), republicans.begin() + trainRepublicans);
+
+    test.insert(test.end(), democrats.begin() + trainDemocrats, democrats.end());
+    test.insert(test.end(), republicans.begin() + trainRepublicans, republicans.end());
+}
+
+void trainNaiveBayes(const std::vector<Record>& train, NaiveBayesModel& model, double lambda) {
+    model = NaiveBayesModel(lambda);
+    for (const auto& record : train) {
+        model.add(record);
+    }
+    model.refresh();
+}
+
+int predict(const Record& record, NaiveBayesModel& model) {
+    model.refresh();
+    double logLikelihood[NUM_CLASSES] = { model.logClassProbabilities[DEMOCRAT], model.logClassProbabilities[REPUBLICAN] };
+
+    for (int c = 0; c < NUM_CLASSES; ++c) {
+        for (int i = 0; i < NUM_ATTRIBUTES; ++i) {
+            logLikelihood[c] += model.logProbabilities[c][i][record.attribute(i)];
+        }
+    }
+    return logLikelihood[DEMOCRAT] > logLikelihood[REPUBLICAN] ? DEMOCRAT : REPUBLICAN;
+}
+
+double scorePacked(uint32_t votes, const NaiveBayesModel& model) {
+    double score = model.priorScore;
+    for (int b = 0; b < NUM_VOTE_BYTES; ++b) {
+        score += model.byteScores[b][(votes >> (8 * b)) & 0xFF];
+    }
+    return score;
+}
+
+void predictBatch(const uint32_t* votes, size_t count, uint8_t* labels, NaiveBayesModel& model) {
+    model.refresh();
+    size_t r = 0;
+#ifdef __AVX2__
+    const __m128i byteMask = _mm_set1_epi32(0xFF);
+    const __m256d prior = _mm256_set1_pd(model.priorScore);
+    const __m256d zero = _mm256_setzero_pd();
+    const __m256d allLanes = _mm256_castsi256_pd(_mm256_set1_epi64x(-1));
+    for (; r + 4 <= count; r += 4) {
+        __m128i packed = _mm_loadu_si128(reinterpret_cast<const __m128i*>(votes + r));
+        __m256d score = prior;
+        for (int b = 0; b < NUM_VOTE_BYTES; ++b) {
+            __m128i index = _mm_and_si128(_mm_srli_epi32(packed, 8 * b), byteMask);
+            score = _mm256_add_pd(score, _mm256_mask_i32gather_pd(zero, model.byteScores[b], index, allLanes, 8));
+        }
+        int isDemocrat = _mm256_movemask_pd(_mm256_cmp_pd(score, zero, _CMP_GT_OQ));
+        for (int k = 0; k < 4; ++k) {
+            labels[r + k] = ((isDemocrat >> k) & 1) ? DEMOCRAT : REPUBLICAN;
+        }
+    }
+#endif
+    for (; r < count; ++r) {
+        labels[r] = scorePacked(votes[r], model) > 0.0 ? DEMOCRAT : REPUBLICAN;
+    }
+}
+
+double accuracy(const Record* records, size_t count, NaiveBayesModel& model) {
+    constexpr size_t BATCH_SIZE = 1024;
+    uint32_t votes[BATCH_SIZE];
+    uint8_t labels[BATCH_SIZE];
+
+    int correct = 0;
+    for (size_t start = 0; start < count; start += BATCH_SIZE) {
+        size_t batch = std::min(BATCH_SIZE, count - start);
+        for (size_t i = 0; i < batch; ++i) {
+            votes[i] = records[start + i].votes;
+        }
+        predictBatch(votes, batch, labels, model);
+        for (size_t i = 0; i < batch; ++i) {
+            if (labels[i] == records[start + i].classLabel) correct++;
+        }
+    }
+    return static_cast<double>(correct) / count;
+}
+
+double accuracy(const std::vector<Record>& records, NaiveBayesModel& model) {
+    return accuracy(records.data(), records.size(), model);
+}
+
+double myAccumulate(const std::vector<double>& vec) {
+    double sum = 0.0;
+    for (size_t i = 0; i < vec.size(); ++i) {
+        sum += vec[i];
+    }
+    return sum;
+}
+
+std::vector<double> crossValidationAccuracies(const std::vector<Record>& train, int k, double lambda) {
+    std::vector<double> accuracies(k);
+
+    NaiveBayesModel globalModel(lambda);
+    for (const auto& record : train) {
+        globalModel.add(record);
+    }
+
+    size_t foldSize = train.size() / k;
+    auto evaluateFolds = [&](int firstFold, int stride) {
+        for (int i = firstFold; i < k; i += stride) {
+            const Record* foldTest = train.data() + i * foldSize;
+
+            NaiveBayesModel model = globalModel;
+            for (size_t j = 0; j < foldSize; ++j) {
+                model.remove(foldTest[j]);
+            }
+
+            accuracies[i] = accuracy(foldTest, foldSize, model);
+        }
+    };
+
+    int threadCount = std::max(1, std::min<int>(k, std::thread::hardware_concurrency()));
+    std::vector<std::thread> workers;
+    for (int t = 1; t < threadCount; ++t) {
+        workers.emplace_back(evaluateFolds, t, threadCount);
+    }
+    evaluateFolds(0, threadCount);
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    return accuracies;
+}
+
+void crossValidation(const std::vector<Record>& train, int k, double& meanAccuracy, double& stdDev, double lambda = 1.0) {
+    std::vector<double> accuracies = crossValidationAccuracies(train, k, lambda);
+
+    meanAccuracy = myAccumulate(accuracies) / k;
+    double variance = 0.0;
+    for (double acc : accuracies) variance += std::pow(acc - meanAccuracy, 2);
+    stdDev = std::sqrt(variance / k);
+
+    std::cout << "10-Fold Cross-Validation Results:" << std::endl;
+    for (int i = 0; i < k; ++i) {
+        std::cout << "    Accuracy Fold " << i + 1 << ": " << std::fixed << std::setprecision(2) << accuracies[i] * 100 << "%" << std::endl;
+    }
+    std::cout << std::endl;
+}
+
+bool readCategoricalData(const std::string& filename, CategoricalDataSet& data) {
+    MappedFile file(filename);
+    if (!file.isOpen()) {
+        std::cerr << "Error while opening the file." << std::endl;
+        return false;
+    }
+
+    std::vector<std::unordered_map<std::string, uint16_t>> dictionaries;
+    auto encode = [&](size_t column, const char* begin, const char* end, std::vector<std::string>& names, uint16_t& code) {
+        if (column == dictionaries.size()) {
+            dictionaries.emplace_back();
+        }
+        std::string value(begin, end);
+        auto found = dictionaries[column].find(value);
+        if (found != dictionaries[column].end()) {
+            code = found->second;
+            return true;
+        }
+        if (names.size() > UINT16_MAX) {
+            std::cerr << "Column " << column << " of " << filename << " has more than " << UINT16_MAX + 1 << " distinct values." << std::endl;
+            return false;
+        }
+        code = static_cast<uint16_t>(names.size());
+        dictionaries[column].emplace(value, code);
+        names.push_back(value);
+        return true;
+    };
+
+    const char* end = file.data + file.size;
+    const char* lineStart = file.data;
+    while (lineStart < end) {
+        const char* lineEnd = static_cast<const char*>(memchr(lineStart, '\n', end - lineStart));
+        if (lineEnd == nullptr) {
+            lineEnd = end;
+        }
+        const char* contentEnd = (lineEnd > lineStart && lineEnd[-1] == '\r') ? lineEnd - 1 : lineEnd;
+
+        if (contentEnd > lineStart) {
+            size_t column = 0;
+            const char* token = lineStart;
+            while (true) {
+                const char* tokenEnd = static_cast<const char*>(memchr(token, ',', contentEnd - token));
+                if (tokenEnd == nullptr) {
+                    tokenEnd = contentEnd;
+                }
+                uint16_t code;
+                if (column == 0) {
+                    if (!encode(column, token, tokenEnd, data.schema.classNames, code)) {
+                        return false;
+                    }
+                    data.labels.push_back(code);
+                }
+                else {
+                    if (column > data.schema.attributeValues.size()) {
+                        if (data.size > 0) {
+                            std::cerr << "Inconsistent number of columns in " << filename << "." << std::endl;
+                            return false;
+                        }
+                        data.schema.attributeValues.emplace_back();
+                    }
+                    if (!encode(column, token, tokenEnd, data.schema.attributeValues[column - 1], code)) {
+                        return false;
+                    }
+                    data.codes.push_back(code);
+                }
+                column++;
+                if (tokenEnd == contentEnd) {
+                    break;
+                }
+                token = tokenEnd + 1;
+            }
+
+            if (column - 1 != data.schema.attributeValues.size()) {
+                std::cerr << "Inconsistent number of columns in " << filename << "." << std::endl;
+                return false;
+            }
+            data.size++;
+        }
+        lineStart = std::min(lineEnd + 1, end);
+    }
+    return true;
+}
+
+#ifndef SOLVER_LIBRARY
+int main() {
+    std::string filename = "house-votes-84.data";
+    std::vector<Record> records;
+
+    int input;
+    std::string line;
+
+    while (true) {
+        std::getline(std::cin, line);  
+
+        if (line.length() == 1 && (line[0] == '0' || line[0] == '1')) {
+            input = line[0] - '0';  
+            break;  
+        }
+        else {
+            std::cout << "Invalid input. Please enter 0 or 1. "; 
+        }
+    }
+
+    readData(filename, input, records);  
+
+    std::vector<Record> train, test;
+    stratifiedSplit(records, train, test, 0.8);
+
+    NaiveBayesModel model;
+    trainNaiveBayes(train, model, 1.0); 
+
+    std::cout << std::endl << "1. Train Set Accuracy:" << std::endl;
+    std::cout << "   Accuracy: " << std::fixed << std::setprecision(2) << accuracy(train, model) * 100 << "%" << std::endl << std::endl;
+
+    double meanAccuracy, stdDev;
+    crossValidation(train, 10, meanAccuracy, stdDev);
+    std::cout << "    Average Accuracy: " << std::fixed << std::setprecision(2) << meanAccuracy * 100 << "%" << std::endl;
+    std::cout << "    Standard Deviation: " << std::fixed << std::setprecision(2) << stdDev * 100 << "%" << std::endl << std::endl;
+
+    std::cout << "2. Test Set Accuracy:" << std::endl;
+    std::cout << "   Accuracy: " << std::fixed << std::setprecision(2) << accuracy(test, model) * 100 << "%" << std::endl;
+
+    return 0;
+}
+#endif
@@ -0,0 +1,332 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+constexpr int NUM_ATTRIBUTES = 16;
+constexpr int NUM_CLASSES = 2;
+constexpr int NUM_VOTE_VALUES = 4;
+constexpr int VOTE_BITS = 2;
+constexpr int NUM_VOTE_BYTES = NUM_ATTRIBUTES * VOTE_BITS / 8;
+
+static_assert(NUM_ATTRIBUTES * VOTE_BITS <= 32, "votes must fit in one 32-bit word");
+static_assert(NUM_ATTRIBUTES * VOTE_BITS % 8 == 0, "votes must fill whole bytes");
+
+enum ClassLabel {
+    DEMOCRAT = 0,
+    REPUBLICAN = 1
+};
+
+enum Vote {
+    NO = 0,
+    YES = 1,
+    ABSTAIN = 2,
+    MISSING = 3
+};
+
+struct Record {
+    ClassLabel classLabel;
+    uint32_t votes = 0;
+
+    Vote attribute(int i) const {
+        return static_cast<Vote>((votes >> (VOTE_BITS * i)) & 3u);
+    }
+
+    void setAttribute(int i, Vote vote) {
+        votes = (votes & ~(3u << (VOTE_BITS * i))) | (static_cast<uint32_t>(vote) << (VOTE_BITS * i));
+    }
+};
+
+struct NaiveBayesModel {
+    double lambda;
+    int totalCount = 0;
+    int classCounts[NUM_CLASSES] = { 0 };
+    int attributeCounts[NUM_CLASSES][NUM_ATTRIBUTES][3] = { 0 };
+    bool isStale = true;
+
+    double logClassProbabilities[NUM_CLASSES];
+    double logProbabilities[NUM_CLASSES][NUM_ATTRIBUTES][NUM_VOTE_VALUES];
+    alignas(64) double byteScores[NUM_VOTE_BYTES][256];
+    double priorScore;
+
+    explicit NaiveBayesModel(double lambda = 1.0) : lambda(lambda) {}
+
+    void add(const Record& record) {
+        update(record, 1);
+    }
+
+    void remove(const Record& record) {
+        update(record, -1);
+    }
+
+    void update(const Record& record, int delta) {
+        int label = record.classLabel;
+        totalCount += delta;
+        classCounts[label] += delta;
+        for (int i = 0; i < NUM_ATTRIBUTES; ++i) {
+            Vote vote = record.attribute(i);
+            if (vote != MISSING) {
+                attributeCounts[label][i][vote] += delta;
+            }
+        }
+        isStale = true;
+    }
+
+    void merge(const NaiveBayesModel& other) {
+        totalCount += other.totalCount;
+        for (int c = 0; c < NUM_CLASSES; ++c) {
+            classCounts[c] += other.classCounts[c];
+            for (int i = 0; i < NUM_ATTRIBUTES; ++i) {
+                for (int v = 0; v < 3; ++v) {
+                    attributeCounts[c][i][v] += other.attributeCounts[c][i][v];
+                }
+            }
+        }
+        isStale = true;
+    }
+
+    void refresh() {
+        if (!isStale) {
+            return;
+        }
+
+        for (int c = 0; c < NUM_CLASSES; ++c) {
+            logClassProbabilities[c] = log((classCounts[c] + lambda) / (totalCount + NUM_CLASSES * lambda));
+            for (int i = 0; i < NUM_ATTRIBUTES; ++i) {
+                for (int v = 0; v < 3; ++v) {
+                    logProbabilities[c][i][v] = log((attributeCounts[c][i][v] + lambda) / (classCounts[c] + 3 * lambda));
+                }
+                logProbabilities[c][i][MISSING] = 0.0;
+            }
+        }
+
+        buildByteScores();
+        isStale = false;
+    }
+
+    void buildByteScores() {
+        priorScore = logClassProbabilities[DEMOCRAT] - logClassProbabilities[REPUBLICAN];
+
+        for (int b = 0; b < NUM_VOTE_BYTES; ++b) {
+            for (int byte = 0; byte < 256; ++byte) {
+                double score = 0.0;
+                for (int j = 0; j < 4; ++j) {
+                    int i = b * 4 + j;
+                    int v = (byte >> (VOTE_BITS * j)) & 3;
+                    score += logProbabilities[DEMOCRAT][i][v] - logProbabilities[REPUBLICAN][i][v];
+                }
+                byteScores[b][byte] = score;
+            }
+        }
+    }
+};
+
+void readData(const std::string& filename, bool treatMissingAsAbstain, std::vector<Record>& records);
+size_t ingestVoteLog(const std::string& filename, size_t offset, bool treatMissingAsAbstain, NaiveBayesModel& model);
+void stratifiedSplit(const std::vector<Record>& records, std::vector<Record>& train, std::vector<Record>& test, double splitRatio);
+void trainNaiveBayes(const std::vector<Record>& train, NaiveBayesModel& model, double lambda);
+int predict(const Record& record, NaiveBayesModel& model);
+void predictBatch(const uint32_t* votes, size_t count, uint8_t* labels, NaiveBayesModel& model);
+double accuracy(const Record* records, size_t count, NaiveBayesModel& model);
+double accuracy(const std::vector<Record>& records, NaiveBayesModel& model);
+std::vector<double> crossValidationAccuracies(const std::vector<Record>& train, int k, double lambda);
+
+constexpr int DYNAMIC = 0;
+
+struct CategoricalSchema {
+    std::vector<std::string> classNames;
+    std::vector<std::vector<std::string>> attributeValues;
+
+    int numClasses() const {
+        return static_cast<int>(classNames.size());
+    }
+
+    int numAttributes() const {
+        return static_cast<int>(attributeValues.size());
+    }
+
+    int numValues(int attribute) const {
+        return static_cast<int>(attributeValues[attribute].size());
+    }
+
+    int maxValues() const {
+        int result = 0;
+        for (const auto& values : attributeValues) {
+            result = std::max(result, static_cast<int>(values.size()));
+        }
+        return result;
+    }
+};
+
+struct CategoricalDataSet {
+    CategoricalSchema schema;
+    size_t size = 0;
+    std::vector<uint16_t> codes;
+    std::vector<uint16_t> labels;
+
+    const uint16_t* row(size_t i) const {
+        return codes.data() + i * schema.numAttributes();
+    }
+};
+
+bool readCategoricalData(const std::string& filename, CategoricalDataSet& data);
+
+template <int NumClasses = DYNAMIC, int NumAttributes = DYNAMIC, int NumValues = DYNAMIC>
+struct CategoricalNaiveBayes {
+    static_assert(NumClasses > 0 && NumAttributes > 0 && NumValues > 0, "fixed shapes must be positive");
+
+    double lambda;
+    int totalCount = 0;
+    int numValues[NumAttributes];
+    int classCounts[NumClasses] = { 0 };
+    int attributeCounts[NumAttributes][NumValues][NumClasses] = { 0 };
+    bool isStale = true;
+
+    double logClassProbabilities[NumClasses];
+    double logProbabilities[NumAttributes][NumValues][NumClasses];
+
+    static bool fits(const CategoricalSchema& schema) {
+        return schema.numClasses() == NumClasses && schema.numAttributes() == NumAttributes && schema.maxValues() <= NumValues;
+    }
+
+    CategoricalNaiveBayes(const CategoricalSchema& schema, double lambda) : lambda(lambda) {
+        if (!fits(schema)) {
+            throw std::invalid_argument("schema does not fit the fixed CategoricalNaiveBayes shape");
+        }
+        for (int i = 0; i < NumAttributes; ++i) {
+            numValues[i] = schema.numValues(i);
+        }
+    }
+
+    void update(const uint16_t* codes, int label, int delta) {
+        totalCount += delta;
+        classCounts[label] += delta;
+        for (int i = 0; i < NumAttributes; ++i) {
+            attributeCounts[i][codes[i]][label] += delta;
+        }
+        isStale = true;
+    }
+
+    void add(const uint16_t* codes, int label) {
+        update(codes, label, 1);
+    }
+
+    void remove(const uint16_t* codes, int label) {
+        update(codes, label, -1);
+    }
+
+    void refresh() {
+        if (!isStale) {
+            return;
+        }
+        for (int c = 0; c < NumClasses; ++c) {
+            logClassProbabilities[c] = log((classCounts[c] + lambda) / (totalCount + NumClasses * lambda));
+            for (int i = 0; i < NumAttributes; ++i) {
+                for (int v = 0; v < NumValues; ++v) {
+                    logProbabilities[i][v][c] = log((attributeCounts[i][v][c] + lambda) / (classCounts[c] + numValues[i] * lambda));
+                }
+            }
+        }
+        isStale = false;
+    }
+
+    int predict(const uint16_t* codes) {
+        refresh();
+        double logLikelihood[NumClasses];
+        for (int c = 0; c < NumClasses; ++c) {
+            logLikelihood[c] = logClassProbabilities[c];
+        }
+        for (int i = 0; i < NumAttributes; ++i) {
+            for (int c = 0; c < NumClasses; ++c) {
+                logLikelihood[c] += logProbabilities[i][codes[i]][c];
+            }
+        }
+        return static_cast<int>(std::max_element(logLikelihood, logLikelihood + NumClasses) - logLikelihood);
+    }
+};
+
+template <>
+struct CategoricalNaiveBayes<DYNAMIC, DYNAMIC, DYNAMIC> {
+    double lambda;
+    int numClasses;
+    int numAttributes;
+    int totalCount = 0;
+    std::vector<int> numValues;
+    std::vector<int> valueOffsets;
+    std::vector<int> classCounts;
+    std::vector<int> attributeCounts;
+    bool isStale = true;
+
+    std::vector<double> logClassProbabilities;
+    std::vector<double> logProbabilities;
+    std::vector<double> logLikelihood;
+
+    static bool fits(const CategoricalSchema&) {
+        return true;
+    }
+
+    CategoricalNaiveBayes(const CategoricalSchema& schema, double lambda)
+        : lambda(lambda), numClasses(schema.numClasses()), numAttributes(schema.numAttributes()) {
+        int offset = 0;
+        for (int i = 0; i < numAttributes; ++i) {
+            numValues.push_back(schema.numValues(i));
+            valueOffsets.push_back(offset);
+            offset += schema.numValues(i) * numClasses;
+        }
+        classCounts.assign(numClasses, 0);
+        attributeCounts.assign(offset, 0);
+        logClassProbabilities.assign(numClasses, 0.0);
+        logProbabilities.assign(offset, 0.0);
+        logLikelihood.assign(numClasses, 0.0);
+    }
+
+    void update(const uint16_t* codes, int label, int delta) {
+        totalCount += delta;
+        classCounts[label] += delta;
+        for (int i = 0; i < numAttributes; ++i) {
+            attributeCounts[valueOffsets[i] + codes[i] * numClasses + label] += delta;
+        }
+        isStale = true;
+    }
+
+    void add(const uint16_t* codes, int label) {
+        update(codes, label, 1);
+    }
+
+    void remove(const uint16_t* codes, int label) {
+        update(codes, label, -1);
+    }
+
+    void refresh() {
+        if (!isStale) {
+            return;
+        }
+        for (int c = 0; c < numClasses; ++c) {
+            logClassProbabilities[c] = log((classCounts[c] + lambda) / (totalCount + numClasses * lambda));
+            for (int i = 0; i < numAttributes; ++i) {
+                for (int v = 0; v < numValues[i]; ++v) {
+                    int index = valueOffsets[i] + v * numClasses + c;
+                    logProbabilities[index] = log((attributeCounts[index] + lambda) / (classCounts[c] + numValues[i] * lambda));
+                }
+            }
+        }
+        isStale = false;
+    }
+
+    int predict(const uint16_t* codes) {
+        refresh();
+        std::copy(logClassProbabilities.begin(), logClassProbabilities.end(), logLikelihood.begin());
+        for (int i = 0; i < numAttributes; ++i) {
+            const double* row = logProbabilities.data() + valueOffsets[i] + codes[i] * numClasses;
+            for (int c = 0; c < numClasses; ++c) {
+                logLikelihood[c] += row[c];
+            }
+        }
+        return static_cast<int>(std::max_element(logLikelihood.begin(), logLikelihood.end()) - logLikelihood.begin());
+    }
+};
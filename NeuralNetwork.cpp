@@ -1,9 +1,12 @@
+#include "NeuralNetwork.h"
+
 #include <iostream>
 #include <vector>
 #include <cmath>
 #include <cstdlib>
 #include <ctime>
 #include <iomanip>
+#include <stdexcept>
 
 using namespace std;
 
@@ -60,8 +63,6 @@ private:
 public:
     NeuralNetwork(const vector<int>& topology, int activationType)
         : activationType(activationType) {
-        srand((unsigned int)time(nullptr));
-
         for (int nodes : topology) {
             layers.push_back(vector<double>(nodes, 0.0));
         }
@@ -141,11 +142,41 @@ vector<vector<double>> getTargets(const string& function) {
     return {};
 }
 
+vector<double> trainBooleanFunction(const string& function, const vector<int>& hiddenLayers, int activationType, int epochs, double learningRate) {
+    vector<vector<double>> targets = getTargets(function);
+    if (targets.empty()) {
+        throw invalid_argument("unknown boolean function: " + function);
+    }
+
+    vector<int> topology = { 2 };
+    topology.insert(topology.end(), hiddenLayers.begin(), hiddenLayers.end());
+    topology.push_back(1);
+
+    NeuralNetwork nn(topology, activationType);
+
+    vector<vector<double>> inputs = {
+        {0, 0},
+        {0, 1},
+        {1, 0},
+        {1, 1}
+    };
+    nn.train(inputs, targets, epochs, learningRate);
+
+    vector<double> outputs;
+    for (const auto& input : inputs) {
+        outputs.push_back(nn.feedForward(input)[0]);
+    }
+    return outputs;
+}
+
+#ifndef SOLVER_LIBRARY
 int main() {
     string function;
     int activation, hiddenLayers;
     vector<int> neuronsPerLayer;
 
+    srand((unsigned int)time(nullptr));
+
     cout << "Input boolean function: ";
     cin >> function;
     cout << "Input activation function: ";
@@ -207,3 +238,4 @@ int main() {
 
     return 0;
 }
+#endif
@@ -0,0 +1,6 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+std::vector<double> trainBooleanFunction(const std::string& function, const std::vector<int>& hiddenLayers, int activationType, int epochs, double learningRate);
@@ -1,5 +1,9 @@
+#include "SlidingBlocks.h"
+#include "SolverTrace.h"
+
 #include <iostream>
 #include <chrono>
+#include <cstring>
 
 using namespace std;
 
@@ -141,23 +145,22 @@ void removeFromPath() {
 }
 
 int search(int g, int threshold) {
+    TRACE_COUNT("ida.nodes", 1);
     int f = g + manhattanDist();
     if (f > threshold) {
         return f;
     }
     if (isGoal()) {
-        cout << pathSize - 1 << endl;
-        for (int i = 1; i < pathSize; i++) {
-            cout << path[i] << endl;
-        }
         return FOUND;
     }
+    TRACE_COUNT("ida.expanded", 1);
 
     int min = MAX_INT_SIZE;
     int temp;
 
     if ((pathSize == 0 || strcmp(path[pathSize - 1], "left") != 0) && moveRight()) {
         addToPath("right");
+        TRACE_COUNT("ida.children", 1);
         temp = search(g + 1, threshold);
         if (temp == FOUND) {
             return FOUND;
@@ -170,6 +173,7 @@ int search(int g, int threshold) {
     }
     if ((pathSize == 0 || strcmp(path[pathSize - 1], "right") != 0) && moveLeft()) {
         addToPath("left");
+        TRACE_COUNT("ida.children", 1);
         temp = search(g + 1, threshold);
         if (temp == FOUND) {
             return FOUND;
@@ -182,6 +186,7 @@ int search(int g, int threshold) {
     }
     if ((pathSize == 0 || strcmp(path[pathSize - 1], "down") != 0) && moveUp()) {
         addToPath("up");
+        TRACE_COUNT("ida.children", 1);
         temp = search(g + 1, threshold);
         if (temp == FOUND) {
             return FOUND;
@@ -194,6 +199,7 @@ int search(int g, int threshold) {
     }
     if ((pathSize == 0 || strcmp(path[pathSize - 1], "up") != 0) && moveDown()) {
         addToPath("down");
+        TRACE_COUNT("ida.children", 1);
         temp = search(g + 1, threshold);
         if (temp == FOUND) {
             return FOUND;
@@ -215,7 +221,12 @@ void idaStar() {
     int temp;
 
     while (true) {
+        TRACE_SCOPE("ida.iteration");
+        TRACE_COUNTER_WINDOW(iterationCounters);
+        TRACE_SAMPLE("ida.threshold", threshold);
         temp = search(0, threshold);
+        TRACE_SAMPLE_COUNTER(iterationCounters, "ida.iteration_nodes", "ida.nodes");
+        TRACE_SAMPLE_RATIO(iterationCounters, "ida.mean_branching_factor", "ida.children", "ida.expanded");
         if (temp == FOUND) {
             break;
         }
@@ -243,47 +254,76 @@ bool isSolvable() {
     }
 }
 
-int main() {
-    int n, index;
-    cin >> n >> index;
+bool solveSlidingBlocks(const vector<int>& board, int goalIndex, vector<string>& moves) {
+    int n = board.size() - 1;
     tiles = new int[n + 1];
-    int tile;
     for (int i = 0; i <= n; i++) {
-        cin >> tile;
-        tiles[i] = tile;
+        tiles[i] = board[i];
     }
 
     boardSize = squareRoot(n + 1);
 
-    if (index == -1) {
+    if (goalIndex == -1) {
         goalIndexOfZero = boardSize * boardSize - 1;
     }
     else {
-        goalIndexOfZero = index;
+        goalIndexOfZero = goalIndex;
     }
 
     currentTileIndexOfZero = posOfZero();
 
-    if (!isSolvable()) {
-        cout << -1 << endl;
-        delete[] tiles;
-        return 0;
+    moves.clear();
+    bool solvable = isSolvable();
+    if (solvable) {
+        pathSize = 0;
+        pathCapacity = 100;
+        idaStar();
+
+        for (int i = 1; i < pathSize; i++) {
+            moves.push_back(path[i]);
+        }
+        for (int i = 0; i < pathSize; i++) {
+            delete[] path[i];
+        }
+        delete[] path;
+        pathSize = 0;
+    }
+
+    delete[] tiles;
+    return solvable;
+}
+
+#ifndef SOLVER_LIBRARY
+int main() {
+    int n, index;
+    cin >> n >> index;
+    vector<int> board(n + 1);
+    for (int i = 0; i <= n; i++) {
+        cin >> board[i];
     }
 
     auto start = chrono::high_resolution_clock::now();
 
-    idaStar();
+    vector<string> moves;
+    bool solvable = solveSlidingBlocks(board, index, moves);
 
     auto end = chrono::high_resolution_clock::now();
 
+    if (!solvable) {
+        cout << -1 << endl;
+        TRACE_WRITE("sliding-blocks-trace.json");
+        return 0;
+    }
+
+    cout << moves.size() << endl;
+    for (const string& move : moves) {
+        cout << move << endl;
+    }
+
     chrono::duration<double> duration = end - start;
 
     cout << duration.count() << endl;
-
-    delete[] tiles;
-    for (int i = 0; i < pathSize; i++) {
-        delete[] path[i];
-    }
-    delete[] path;
+    TRACE_WRITE("sliding-blocks-trace.json");
     return 0;
-}
\ No newline at end of file
+}
+#endif
@@ -0,0 +1,6 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+bool solveSlidingBlocks(const std::vector<int>& board, int goalIndexOfZero, std::vector<std::string>& moves);
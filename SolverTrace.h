@@ -0,0 +1,217 @@
+#pragma once
+
+// Hot-path instrumentation for the search solvers. Build with SOLVER_TRACE
+// defined (cmake -DENABLE_SOLVER_TRACE=ON) to collect thread-local counters,
+// scoped timers and counter samples, and TRACE_WRITE them as a Chrome trace /
+// Perfetto JSON file. Counter samples are taken relative to a TRACE_COUNTER_WINDOW
+// declared at the start of the measured scope, so they cover only that scope.
+// Without SOLVER_TRACE every macro expands to nothing.
+
+#ifdef SOLVER_TRACE
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace solver_trace {
+
+constexpr int MAX_COUNTERS = 32;
+
+struct Event {
+    const char* name;
+    char phase;
+    double timestamp;
+    double value;
+};
+
+struct ThreadBuffer {
+    uint32_t threadId;
+    std::vector<Event> events;
+    uint64_t counters[MAX_COUNTERS] = { 0 };
+};
+
+inline std::mutex& registryMutex() {
+    static std::mutex mutex;
+    return mutex;
+}
+
+inline std::vector<std::shared_ptr<ThreadBuffer>>& threadBuffers() {
+    static std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+    return buffers;
+}
+
+inline std::vector<const char*>& counterNames() {
+    static std::vector<const char*> names;
+    return names;
+}
+
+inline ThreadBuffer& localBuffer() {
+    thread_local std::shared_ptr<ThreadBuffer> buffer = [] {
+        std::lock_guard<std::mutex> lock(registryMutex());
+        auto created = std::make_shared<ThreadBuffer>();
+        created->threadId = static_cast<uint32_t>(threadBuffers().size());
+        threadBuffers().push_back(created);
+        return created;
+    }();
+    return *buffer;
+}
+
+inline double now() {
+    static const auto start = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+}
+
+inline int registerCounter(const char* name) {
+    std::lock_guard<std::mutex> lock(registryMutex());
+    std::vector<const char*>& names = counterNames();
+    for (size_t i = 0; i < names.size(); ++i) {
+        if (std::string(names[i]) == name) {
+            return static_cast<int>(i);
+        }
+    }
+    if (names.size() == MAX_COUNTERS) {
+        std::cerr << "SolverTrace: cannot register " << name << ", all " << MAX_COUNTERS << " counters are in use" << std::endl;
+        std::abort();
+    }
+    names.push_back(name);
+    return static_cast<int>(names.size() - 1);
+}
+
+inline void sample(const char* name, double value) {
+    localBuffer().events.push_back({ name, 'C', now(), value });
+}
+
+struct CounterWindow {
+    uint64_t start[MAX_COUNTERS];
+
+    CounterWindow() {
+        const ThreadBuffer& buffer = localBuffer();
+        std::copy(buffer.counters, buffer.counters + MAX_COUNTERS, start);
+    }
+
+    uint64_t delta(int counter) const {
+        return localBuffer().counters[counter] - start[counter];
+    }
+
+    void sampleDelta(const char* name, int counter) const {
+        sample(name, static_cast<double>(delta(counter)));
+    }
+
+    void sampleRatio(const char* name, int numerator, int denominator) const {
+        double total = static_cast<double>(delta(denominator));
+        sample(name, total > 0 ? delta(numerator) / total : 0.0);
+    }
+};
+
+struct RateSampler {
+    double lastTimestamp = now();
+    uint64_t lastCount = 0;
+    bool isFirst = true;
+
+    void sample(const char* name, int counter) {
+        double timestamp = now();
+        uint64_t count = localBuffer().counters[counter];
+        if (!isFirst && timestamp > lastTimestamp) {
+            solver_trace::sample(name, (count - lastCount) / ((timestamp - lastTimestamp) * 1e-6));
+        }
+        isFirst = false;
+        lastTimestamp = timestamp;
+        lastCount = count;
+    }
+};
+
+class ScopedTimer {
+public:
+    explicit ScopedTimer(const char* name) : name(name) {
+        localBuffer().events.push_back({ name, 'B', now(), 0 });
+    }
+
+    ~ScopedTimer() {
+        localBuffer().events.push_back({ name, 'E', now(), 0 });
+    }
+
+private:
+    const char* name;
+};
+
+inline bool write(const std::string& defaultPath) {
+    const char* overridePath = std::getenv("SOLVER_TRACE_FILE");
+    std::string path = overridePath != nullptr ? overridePath : defaultPath;
+    std::ofstream file(path);
+    if (!file.is_open()) {
+        std::cerr << "SolverTrace: error while opening " << path << "." << std::endl;
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(registryMutex());
+    double end = now();
+    bool first = true;
+    auto separator = [&]() -> std::ostream& {
+        file << (first ? "\n    " : ",\n    ");
+        first = false;
+        return file;
+    };
+
+    file << std::fixed;
+    file.precision(3);
+    file << "{\n  \"displayTimeUnit\": \"ms\",\n  \"traceEvents\": [";
+    for (const auto& buffer : threadBuffers()) {
+        for (const Event& event : buffer->events) {
+            separator() << "{\"name\": \"" << event.name << "\", \"ph\": \"" << event.phase
+                << "\", \"ts\": " << event.timestamp << ", \"pid\": 1, \"tid\": " << buffer->threadId;
+            if (event.phase == 'C') {
+                file << ", \"args\": {\"value\": " << event.value << "}";
+            }
+            file << "}";
+        }
+        for (size_t i = 0; i < counterNames().size(); ++i) {
+            if (buffer->counters[i] != 0) {
+                separator() << "{\"name\": \"" << counterNames()[i] << "\", \"ph\": \"C\", \"ts\": " << end
+                    << ", \"pid\": 1, \"tid\": " << buffer->threadId << ", \"args\": {\"value\": " << buffer->counters[i] << "}}";
+            }
+        }
+    }
+    file << "\n  ]\n}\n";
+
+    std::cerr << "SolverTrace: wrote " << path << std::endl;
+    return true;
+}
+
+}
+
+#define SOLVER_TRACE_CONCAT_INNER(a, b) a##b
+#define SOLVER_TRACE_CONCAT(a, b) SOLVER_TRACE_CONCAT_INNER(a, b)
+#define SOLVER_TRACE_COUNTER_ID(name) \
+    ([]() -> int { static const int id = solver_trace::registerCounter(name); return id; }())
+
+#define TRACE_SCOPE(name) solver_trace::ScopedTimer SOLVER_TRACE_CONCAT(solverTraceScope, __LINE__)(name)
+#define TRACE_COUNT(name, amount) (solver_trace::localBuffer().counters[SOLVER_TRACE_COUNTER_ID(name)] += (amount))
+#define TRACE_SAMPLE(name, value) solver_trace::sample(name, static_cast<double>(value))
+#define TRACE_COUNTER_WINDOW(window) solver_trace::CounterWindow window
+#define TRACE_SAMPLE_COUNTER(window, name, counter) (window).sampleDelta(name, SOLVER_TRACE_COUNTER_ID(counter))
+#define TRACE_SAMPLE_RATIO(window, name, numerator, denominator) \
+    (window).sampleRatio(name, SOLVER_TRACE_COUNTER_ID(numerator), SOLVER_TRACE_COUNTER_ID(denominator))
+#define TRACE_RATE_SAMPLER(sampler) solver_trace::RateSampler sampler
+#define TRACE_SAMPLE_RATE(sampler, name, counter) (sampler).sample(name, SOLVER_TRACE_COUNTER_ID(counter))
+#define TRACE_WRITE(path) solver_trace::write(path)
+
+#else
+
+#define TRACE_SCOPE(name) ((void)0)
+#define TRACE_COUNT(name, amount) ((void)0)
+#define TRACE_SAMPLE(name, value) ((void)0)
+#define TRACE_COUNTER_WINDOW(window) ((void)0)
+#define TRACE_SAMPLE_COUNTER(window, name, counter) ((void)0)
+#define TRACE_SAMPLE_RATIO(window, name, numerator, denominator) ((void)0)
+#define TRACE_RATE_SAMPLER(sampler) ((void)0)
+#define TRACE_SAMPLE_RATE(sampler, name, counter) ((void)0)
+#define TRACE_WRITE(path) ((void)0)
+
+#endif
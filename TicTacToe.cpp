@@ -1,3 +1,6 @@
+#include "TicTacToe.h"
+#include "SolverTrace.h"
+
 #include <iostream>
 #include <vector>
 #include <algorithm>
@@ -101,9 +104,11 @@ int evaluateBoard(const Game& game, char currentPlayer, char opponent, int depth
 }
 
 int minMaxAlgorithm(Game& game, int depth, char currentPlayer, char opponent, Move& bestMove, int alpha, int beta) {
+    TRACE_COUNT("minimax.nodes", 1);
     if (game.isGameOver()) {
         return evaluateBoard(game, currentPlayer, opponent, depth);
     }
+    TRACE_COUNT("minimax.expanded", 1);
 
     std::vector<Move> availableMoves = game.getAvailableMoves();
     int bestScore = (game.getCurrentPlayer() == currentPlayer) ? -1000 : 1000;
@@ -129,6 +134,7 @@ int minMaxAlgorithm(Game& game, int depth, char currentPlayer, char opponent, Mo
         }
 
         if (beta <= alpha) {
+            TRACE_COUNT("minimax.cutoffs", 1);
             break;
         }
     }
@@ -136,6 +142,32 @@ int minMaxAlgorithm(Game& game, int depth, char currentPlayer, char opponent, Mo
     return bestScore;
 }
 
+int findComputerMove(Game& game, char computerChar, char playerChar, Move& computerMove) {
+    TRACE_SCOPE("minimax.search");
+    TRACE_COUNTER_WINDOW(searchCounters);
+    int score = minMaxAlgorithm(game, 0, computerChar, playerChar, computerMove, -1000, 1000);
+    TRACE_SAMPLE_COUNTER(searchCounters, "minimax.search_nodes", "minimax.nodes");
+    TRACE_SAMPLE_RATIO(searchCounters, "minimax.cutoff_rate", "minimax.cutoffs", "minimax.expanded");
+    return score;
+}
+
+int solveTicTacToe(const std::string& board, char currentTurn, char computerChar, int& bestRow, int& bestCol) {
+    Game game(currentTurn);
+    for (int i = 0; i < 3; ++i) {
+        for (int j = 0; j < 3; ++j) {
+            game.board[i][j] = board[i * 3 + j];
+        }
+    }
+
+    char opponent = (computerChar == 'X') ? 'O' : 'X';
+    Move bestMove;
+    int score = findComputerMove(game, computerChar, opponent, bestMove);
+    bestRow = bestMove.row;
+    bestCol = bestMove.col;
+    return score;
+}
+
+#ifndef SOLVER_LIBRARY
 int main() {
     Game game('X');
     char playerChar = 'X', computerChar = 'O';
@@ -175,7 +207,7 @@ int main() {
         }
         else {
             Move computerMove;
-            minMaxAlgorithm(game, 0, computerChar, playerChar, computerMove, -1000, 1000);
+            findComputerMove(game, computerChar, playerChar, computerMove);
             game = game.getNextState(computerMove.row, computerMove.col);
             std::cout << "Computer plays: [" << computerMove.row + 1 << ", " << computerMove.col + 1 << "]" << std::endl;
         }
@@ -192,5 +224,7 @@ int main() {
         std::cout << "It's a draw!" << std::endl;
     }
 
+    TRACE_WRITE("tictactoe-trace.json");
     return 0;
 }
+#endif
@@ -0,0 +1,5 @@
+#pragma once
+
+#include <string>
+
+int solveTicTacToe(const std::string& board, char currentTurn, char computerChar, int& bestRow, int& bestCol);
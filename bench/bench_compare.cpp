@@ -0,0 +1,124 @@
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+
+typedef std::map<std::string, double> ThroughputTable;
+
+static bool readStringField(const std::string& text, size_t& position, const std::string& field, std::string& value) {
+    size_t key = text.find("\"" + field + "\"", position);
+    if (key == std::string::npos) {
+        return false;
+    }
+    size_t open = text.find('"', text.find(':', key) + 1);
+    size_t close = open;
+    do {
+        close = text.find('"', close + 1);
+    } while (close != std::string::npos && text[close - 1] == '\\');
+    if (open == std::string::npos || close == std::string::npos) {
+        return false;
+    }
+    value = text.substr(open + 1, close - open - 1);
+    position = close + 1;
+    return true;
+}
+
+static bool readNumberField(const std::string& text, size_t& position, const std::string& field, double& value) {
+    size_t key = text.find("\"" + field + "\"", position);
+    if (key == std::string::npos) {
+        return false;
+    }
+    size_t colon = text.find(':', key);
+    char* end = nullptr;
+    value = std::strtod(text.c_str() + colon + 1, &end);
+    position = end - text.c_str();
+    return true;
+}
+
+static bool loadResultFile(const std::filesystem::path& path, ThroughputTable& table) {
+    std::ifstream file(path);
+    if (!file.is_open()) {
+        std::cerr << "Error while opening " << path.string() << "." << std::endl;
+        return false;
+    }
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+    std::string text = buffer.str();
+
+    size_t position = 0;
+    std::string suite;
+    if (!readStringField(text, position, "suite", suite)) {
+        std::cerr << path.string() << " is not a benchmark result file." << std::endl;
+        return false;
+    }
+
+    std::string name;
+    double throughput;
+    while (readStringField(text, position, "name", name) && readNumberField(text, position, "throughput", throughput)) {
+        table[suite + "/" + name] = throughput;
+    }
+    return true;
+}
+
+static bool loadResults(const std::string& location, ThroughputTable& table) {
+    std::filesystem::path path(location);
+    if (!std::filesystem::is_directory(path)) {
+        return loadResultFile(path, table);
+    }
+    for (const auto& entry : std::filesystem::directory_iterator(path)) {
+        if (entry.path().extension() == ".json" && !loadResultFile(entry.path(), table)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+int main(int argc, char* argv[]) {
+    if (argc < 3) {
+        std::cerr << "Usage: " << argv[0] << " BASELINE CANDIDATE [--threshold PERCENT]" << std::endl;
+        std::cerr << "BASELINE and CANDIDATE are result files or directories of result files." << std::endl;
+        return 2;
+    }
+
+    double threshold = 5.0;
+    for (int i = 3; i < argc; ++i) {
+        if (std::string(argv[i]) == "--threshold" && i + 1 < argc) {
+            threshold = std::atof(argv[++i]);
+        }
+    }
+
+    ThroughputTable baseline, candidate;
+    if (!loadResults(argv[1], baseline) || !loadResults(argv[2], candidate)) {
+        return 2;
+    }
+
+    int regressions = 0;
+    int missing = 0;
+    for (const auto& entry : baseline) {
+        auto match = candidate.find(entry.first);
+        std::cout << "   " << std::left << std::setw(56) << entry.first << std::right;
+        if (match == candidate.end()) {
+            std::cout << "   MISSING from candidate" << std::endl;
+            missing++;
+            continue;
+        }
+
+        double change = entry.second > 0 ? (match->second - entry.second) / entry.second * 100 : 0.0;
+        std::cout << std::fixed << std::setprecision(2) << std::setw(16) << entry.second << " -> "
+            << std::setw(16) << match->second << " items/s  "
+            << std::showpos << std::setprecision(2) << std::setw(8) << change << "%" << std::noshowpos;
+        if (change < -threshold) {
+            std::cout << "  REGRESSION";
+            regressions++;
+        }
+        std::cout << std::endl;
+    }
+
+    std::cout << std::endl << regressions << " regression(s) beyond " << threshold << "%, "
+        << missing << " benchmark(s) missing from candidate." << std::endl;
+    return regressions > 0 || missing > 0 ? 1 : 0;
+}
@@ -0,0 +1,29 @@
+#include "benchmark.h"
+#include "ID3.h"
+
+#include <cstdlib>
+
+int main(int argc, char* argv[]) {
+    BenchmarkRunner runner("ID3", argc, argv);
+
+    std::srand(0);
+    readFromFile(ID3_DATA_FILE);
+    if (!buildValueCodes()) {
+        return 1;
+    }
+    const double rows = static_cast<double>(alldata.size());
+
+    runner.macro("train/pre-pruning", rows, [] {
+        doNotOptimize(calculateTrainAccuracy(alldata, 0));
+    });
+    runner.macro("train/post-pruning", rows, [] {
+        doNotOptimize(calculateTrainAccuracy(alldata, 1));
+    });
+    runner.macro("train/streaming", rows, [] {
+        double accuracy;
+        int rowCount;
+        doNotOptimize(calculateStreamingAccuracy(ID3_DATA_FILE, accuracy, rowCount));
+    });
+
+    return runner.run();
+}
@@ -0,0 +1,68 @@
+#include "benchmark.h"
+#include "NaiveBayesClassifier_CongressionalVoting.h"
+
+#include <iostream>
+#include <memory>
+#include <random>
+
+template <typename Engine>
+void addCategoricalBenchmark(BenchmarkRunner& runner, const std::string& name, const CategoricalDataSet& data, int passes) {
+    if (!Engine::fits(data.schema)) {
+        std::cerr << "Skipping " << name << ": the data set does not fit its fixed shape." << std::endl;
+        return;
+    }
+    auto engine = std::make_shared<Engine>(data.schema, 1.0);
+    for (size_t r = 0; r < data.size; ++r) {
+        engine->add(data.row(r), data.labels[r]);
+    }
+    engine->refresh();
+
+    runner.micro(name, static_cast<double>(data.size) * passes, [engine, &data, passes] {
+        size_t correct = 0;
+        for (int pass = 0; pass < passes; ++pass) {
+            for (size_t r = 0; r < data.size; ++r) {
+                if (engine->predict(data.row(r)) == data.labels[r]) correct++;
+            }
+        }
+        doNotOptimize(correct);
+    });
+}
+
+int main(int argc, char* argv[]) {
+    BenchmarkRunner runner("NaiveBayes", argc, argv);
+
+    std::vector<Record> records;
+    readData(VOTES_DATA_FILE, true, records);
+
+    NaiveBayesModel model;
+    trainNaiveBayes(records, model, 1.0);
+
+    const size_t batchSize = 1 << 20;
+    std::vector<uint32_t> votes(batchSize);
+    std::vector<uint8_t> labels(batchSize);
+    std::mt19937 generator(runner.seed());
+    for (size_t i = 0; i < batchSize; ++i) {
+        votes[i] = records[generator() % records.size()].votes;
+    }
+
+    runner.micro("predict_batch/packed-votes", batchSize, [&] {
+        predictBatch(votes.data(), votes.size(), labels.data(), model);
+        doNotOptimize(labels[0]);
+    });
+
+    CategoricalDataSet data;
+    if (!readCategoricalData(VOTES_DATA_FILE, data)) {
+        return 1;
+    }
+    addCategoricalBenchmark<CategoricalNaiveBayes<>>(runner, "categorical_predict/runtime-schema", data, 200);
+    addCategoricalBenchmark<CategoricalNaiveBayes<NUM_CLASSES, NUM_ATTRIBUTES, 3>>(runner, "categorical_predict/fixed-2-16-3", data, 200);
+
+    runner.macro("cross_validation/10-fold", records.size(), [&] {
+        doNotOptimize(crossValidationAccuracies(records, 10, 1.0));
+    });
+    runner.macro("cross_validation/leave-one-out", records.size(), [&] {
+        doNotOptimize(crossValidationAccuracies(records, static_cast<int>(records.size()), 1.0));
+    });
+
+    return runner.run();
+}
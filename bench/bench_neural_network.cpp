@@ -0,0 +1,15 @@
+#include "benchmark.h"
+#include "NeuralNetwork.h"
+
+int main(int argc, char* argv[]) {
+    BenchmarkRunner runner("NeuralNetwork", argc, argv);
+
+    runner.micro("train/xor-2-4-1/100-epochs", 100 * 4, [] {
+        doNotOptimize(trainBooleanFunction("XOR", { 4 }, 0, 100, 0.1));
+    });
+    runner.macro("train/xor-2-8-8-1/10000-epochs", 10000 * 4, [] {
+        doNotOptimize(trainBooleanFunction("XOR", { 8, 8 }, 1, 10000, 0.1));
+    });
+
+    return runner.run();
+}
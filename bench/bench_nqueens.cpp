@@ -0,0 +1,15 @@
+#include "benchmark.h"
+#include "nQueens.h"
+
+int main(int argc, char* argv[]) {
+    BenchmarkRunner runner("nQueens", argc, argv);
+
+    runner.micro("min_conflicts/n=64", 1, [] {
+        doNotOptimize(minimumConflicts(64));
+    });
+    runner.macro("min_conflicts/n=1000", 1, [] {
+        doNotOptimize(minimumConflicts(1000));
+    });
+
+    return runner.run();
+}
@@ -0,0 +1,20 @@
+#include "benchmark.h"
+#include "SlidingBlocks.h"
+
+int main(int argc, char* argv[]) {
+    BenchmarkRunner runner("SlidingBlocks", argc, argv);
+
+    const std::vector<int> eightPuzzle = { 8, 1, 3, 4, 0, 2, 7, 6, 5 };
+    const std::vector<int> fifteenPuzzle = { 10, 1, 7, 3, 2, 5, 4, 11, 6, 14, 0, 8, 9, 15, 12, 13 };
+
+    runner.micro("ida_star/8-puzzle", 1, [&] {
+        std::vector<std::string> moves;
+        doNotOptimize(solveSlidingBlocks(eightPuzzle, -1, moves));
+    });
+    runner.macro("ida_star/15-puzzle", 1, [&] {
+        std::vector<std::string> moves;
+        doNotOptimize(solveSlidingBlocks(fifteenPuzzle, -1, moves));
+    });
+
+    return runner.run();
+}
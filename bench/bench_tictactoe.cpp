@@ -0,0 +1,17 @@
+#include "benchmark.h"
+#include "TicTacToe.h"
+
+int main(int argc, char* argv[]) {
+    BenchmarkRunner runner("TicTacToe", argc, argv);
+
+    runner.micro("minimax/mid-game", 1, [] {
+        int row, col;
+        doNotOptimize(solveTicTacToe("X   O  X ", 'O', 'O', row, col));
+    });
+    runner.macro("minimax/empty-board", 1, [] {
+        int row, col;
+        doNotOptimize(solveTicTacToe("         ", 'X', 'X', row, col));
+    });
+
+    return runner.run();
+}
@@ -0,0 +1,152 @@
+#include "benchmark.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+
+BenchmarkRunner::BenchmarkRunner(const std::string& suite, int argc, char* argv[]) : suite(suite) {
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (arg == "--warmup" && hasValue) {
+            options.warmup = std::atoi(argv[++i]);
+        }
+        else if (arg == "--repetitions" && hasValue) {
+            options.repetitions = std::max(1, std::atoi(argv[++i]));
+        }
+        else if (arg == "--seed" && hasValue) {
+            options.seed = static_cast<unsigned int>(std::strtoul(argv[++i], nullptr, 10));
+        }
+        else if (arg == "--filter" && hasValue) {
+            options.filter = argv[++i];
+        }
+        else if (arg == "--json" && hasValue) {
+            options.jsonPath = argv[++i];
+        }
+        else {
+            std::cerr << "Usage: " << argv[0] << " [--warmup N] [--repetitions N] [--seed N] [--filter TEXT] [--json FILE]" << std::endl;
+            std::exit(2);
+        }
+    }
+}
+
+void BenchmarkRunner::micro(const std::string& name, double itemsPerRun, std::function<void()> body) {
+    benchmarks.push_back({ name, "micro", itemsPerRun, body });
+}
+
+void BenchmarkRunner::macro(const std::string& name, double itemsPerRun, std::function<void()> body) {
+    benchmarks.push_back({ name, "macro", itemsPerRun, body });
+}
+
+BenchmarkResult BenchmarkRunner::measure(const Benchmark& benchmark) {
+    BenchmarkResult result;
+    result.name = benchmark.name;
+    result.kind = benchmark.kind;
+    result.itemsPerRun = benchmark.itemsPerRun;
+
+    for (int i = 0; i < options.warmup; ++i) {
+        std::srand(options.seed);
+        benchmark.body();
+    }
+
+    for (int i = 0; i < options.repetitions; ++i) {
+        std::srand(options.seed);
+        auto start = std::chrono::steady_clock::now();
+        benchmark.body();
+        auto end = std::chrono::steady_clock::now();
+        result.seconds.push_back(std::chrono::duration<double>(end - start).count());
+    }
+
+    std::vector<double> sorted = result.seconds;
+    std::sort(sorted.begin(), sorted.end());
+    size_t n = sorted.size();
+    result.minSeconds = sorted.front();
+    result.medianSeconds = (n % 2 == 1) ? sorted[n / 2] : (sorted[n / 2 - 1] + sorted[n / 2]) / 2;
+
+    double sum = 0.0;
+    for (double s : sorted) {
+        sum += s;
+    }
+    result.meanSeconds = sum / n;
+
+    double variance = 0.0;
+    for (double s : sorted) {
+        variance += std::pow(s - result.meanSeconds, 2);
+    }
+    result.stdDevSeconds = std::sqrt(variance / n);
+    result.throughput = result.medianSeconds > 0 ? result.itemsPerRun / result.medianSeconds : 0.0;
+    return result;
+}
+
+void BenchmarkRunner::printResult(const BenchmarkResult& result) const {
+    std::cout << "   " << std::left << std::setw(40) << result.name << std::setw(7) << result.kind << std::right
+        << std::fixed << std::setprecision(3)
+        << std::setw(12) << result.medianSeconds * 1e3 << " ms"
+        << "  +/- " << std::setw(8) << result.stdDevSeconds * 1e3 << " ms"
+        << std::setprecision(2) << std::setw(16) << result.throughput << " items/s" << std::endl;
+}
+
+static std::string escapeJson(const std::string& text) {
+    std::string escaped;
+    for (char c : text) {
+        if (c == '"' || c == '\\') {
+            escaped += '\\';
+        }
+        escaped += c;
+    }
+    return escaped;
+}
+
+bool BenchmarkRunner::writeJson() const {
+    std::ofstream file(options.jsonPath);
+    if (!file.is_open()) {
+        std::cerr << "Error while opening " << options.jsonPath << "." << std::endl;
+        return false;
+    }
+
+    file << std::setprecision(9);
+    file << "{\n";
+    file << "  \"suite\": \"" << escapeJson(suite) << "\",\n";
+    file << "  \"seed\": " << options.seed << ",\n";
+    file << "  \"warmup\": " << options.warmup << ",\n";
+    file << "  \"repetitions\": " << options.repetitions << ",\n";
+    file << "  \"benchmarks\": [\n";
+    for (size_t i = 0; i < results.size(); ++i) {
+        const BenchmarkResult& result = results[i];
+        file << "    {\n";
+        file << "      \"name\": \"" << escapeJson(result.name) << "\",\n";
+        file << "      \"kind\": \"" << result.kind << "\",\n";
+        file << "      \"items_per_run\": " << result.itemsPerRun << ",\n";
+        file << "      \"min_seconds\": " << result.minSeconds << ",\n";
+        file << "      \"median_seconds\": " << result.medianSeconds << ",\n";
+        file << "      \"mean_seconds\": " << result.meanSeconds << ",\n";
+        file << "      \"stddev_seconds\": " << result.stdDevSeconds << ",\n";
+        file << "      \"throughput\": " << result.throughput << "\n";
+        file << "    }" << (i + 1 < results.size() ? "," : "") << "\n";
+    }
+    file << "  ]\n";
+    file << "}\n";
+    return true;
+}
+
+int BenchmarkRunner::run() {
+    std::cout << suite << " (seed " << options.seed << ", " << options.warmup << " warm-up, "
+        << options.repetitions << " repetitions):" << std::endl;
+
+    for (const Benchmark& benchmark : benchmarks) {
+        if (!options.filter.empty() && benchmark.name.find(options.filter) == std::string::npos) {
+            continue;
+        }
+        results.push_back(measure(benchmark));
+        printResult(results.back());
+    }
+
+    if (!options.jsonPath.empty() && !writeJson()) {
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+struct BenchmarkOptions {
+    int warmup = 2;
+    int repetitions = 10;
+    unsigned int seed = 20250204;
+    std::string filter;
+    std::string jsonPath;
+};
+
+struct BenchmarkResult {
+    std::string name;
+    std::string kind;
+    double itemsPerRun;
+    std::vector<double> seconds;
+    double minSeconds;
+    double medianSeconds;
+    double meanSeconds;
+    double stdDevSeconds;
+    double throughput;
+};
+
+template <typename T>
+inline void doNotOptimize(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "g"(value) : "memory");
+#else
+    volatile char sink = *reinterpret_cast<const volatile char*>(&value);
+    (void)sink;
+    _ReadWriteBarrier();
+#endif
+}
+
+class BenchmarkRunner {
+public:
+    BenchmarkRunner(const std::string& suite, int argc, char* argv[]);
+
+    void micro(const std::string& name, double itemsPerRun, std::function<void()> body);
+    void macro(const std::string& name, double itemsPerRun, std::function<void()> body);
+
+    unsigned int seed() const { return options.seed; }
+
+    int run();
+
+private:
+    struct Benchmark {
+        std::string name;
+        std::string kind;
+        double itemsPerRun;
+        std::function<void()> body;
+    };
+
+    std::string suite;
+    BenchmarkOptions options;
+    std::vector<Benchmark> benchmarks;
+    std::vector<BenchmarkResult> results;
+
+    BenchmarkResult measure(const Benchmark& benchmark);
+    void printResult(const BenchmarkResult& result) const;
+    bool writeJson() const;
+};
@@ -1,9 +1,13 @@
+#include "nQueens.h"
+#include "SolverTrace.h"
+
 #include <iostream>
 #include <cstdlib>
 #include <ctime>
 #include <chrono>
 #include <vector>
 #include <iomanip>
+#include <algorithm>
 
 typedef std::vector<int> vec;
 
@@ -70,6 +74,8 @@ int pickPosition(const std::vector<int>& row_confs, int N, int min_val) {
 }
 
 std::pair<vec, int> minimumConflicts(int N) {
+    TRACE_SCOPE("min_conflicts.solve");
+    TRACE_RATE_SAMPLER(stepRate);
     const int MAX_STEPS = 1000000;
 
     vec queens = initializeQueens(N);
@@ -82,9 +88,14 @@ std::pair<vec, int> minimumConflicts(int N) {
     }
 
     for (int step = 0; step < MAX_STEPS; step++) {
+        if ((step & 255) == 0) {
+            TRACE_SAMPLE("min_conflicts.total_conflicts", total_conflicts);
+            TRACE_SAMPLE_RATE(stepRate, "min_conflicts.step_rate", "min_conflicts.steps");
+        }
         if (total_conflicts == 0) {
             return { queens, step };
         }
+        TRACE_COUNT("min_conflicts.steps", 1);
 
         std::vector<int> conflict_cols;
         for (int col = 0; col < N; col++) {
@@ -130,6 +141,7 @@ void printSolution(const vec& queens, int N) {
     std::cout << "]\n";
 }
 
+#ifndef SOLVER_LIBRARY
 int main() {
     srand(time(0));
     int N;
@@ -154,5 +166,7 @@ int main() {
         printBoard(result.first, N);
     }
 
+    TRACE_WRITE("nqueens-trace.json");
     return 0;
 }
+#endif
@@ -0,0 +1,6 @@
+#pragma once
+
+#include <utility>
+#include <vector>
+
+std::pair<std::vector<int>, int> minimumConflicts(int N);